@@ -0,0 +1,633 @@
+//---------------------------------------------------------------------------
+// File: ExternalGraph.cpp
+// Author: Snehal Jogdand
+// Date: 10/18/2026
+// Program 3: Dijkstra's algorithm
+//
+// DESCRIPTION:
+// ExternalGraph:
+//  The class file for ExternalGraph class
+//  Provides the set of variables and functions to process a Graph
+//  whose edges and shortest path table are kept on disk
+//---------------------------------------------------------------------------
+
+#include "ExternalGraph.h"
+#include <cstdio>
+#include <iomanip>
+
+using namespace std;
+
+//------------------------------------------------------------------------
+// The constructor that creates a new ExternalGraph object
+// @pre edgeFileName and tableFileName are writable paths
+// @post creates an ExternalGraph object with size 0
+// @param edgeFileName The file that will hold the edges on disk
+// @param tableFileName The file that will hold the shortest path rows
+// @param memoryLimit The number of bytes the edge buffer pool, with its
+//    block lookup table, may use; at least one buffer is always kept
+ExternalGraph::ExternalGraph(const string& edgeFileName, const string& tableFileName,
+   long long memoryLimit) : edgeFileName(edgeFileName), tableFileName(tableFileName),
+   size(0), vertices(nullptr), edgeStart(nullptr), edgeCount(0),
+   frames(nullptr), frameCount(0), newestFrame(-1), oldestFrame(-1),
+   blockSlots(nullptr), slotMask(0), row(nullptr), rowSource(-1) {
+   // every buffer also takes its Frame and at most four lookup slots
+   long long frameBytes = BLOCK_EDGES * (long long)sizeof(EdgeRecord) +
+      (long long)sizeof(Frame) + 4 * (long long)sizeof(int);
+
+   // always keep at least one buffer so that an edge can be read
+   frameCount = (int)(memoryLimit / frameBytes);
+   if (frameCount < 1)
+      frameCount = 1;
+
+   frames = new Frame[frameCount];
+   for (int i = 0; i < frameCount; i++) {
+      frames[i].block = -1;
+      frames[i].count = 0;
+      frames[i].prevFrame = i - 1;
+      frames[i].nextFrame = i + 1 < frameCount ? i + 1 : -1;
+      frames[i].edges = new EdgeRecord[BLOCK_EDGES];
+   }
+   newestFrame = 0;
+   oldestFrame = frameCount - 1;
+
+   // at least twice as many slots as buffers keeps the probes short
+   int slotCount = 2;
+   while (slotCount < 2 * frameCount)
+      slotCount *= 2;
+   slotMask = slotCount - 1;
+
+   blockSlots = new int[slotCount];
+   for (int s = 0; s < slotCount; s++)
+      blockSlots[s] = -1;
+}
+
+//-------------------------------- buildGraph ---------------------------------
+// Builds a graph by reading data from an ifstream
+// Preconditions:  infile has been successfully opened and the file contains
+//                 properly formated data (according to the program specs)
+// Postconditions: One graph is read from infile, its edges are written to
+//                 the edge file grouped by source vertex
+void ExternalGraph::buildGraph(ifstream& infile) {
+   deleteGraph();
+
+   infile >> size;                          // data member stores array size
+   if (infile.eof()) {
+      size = 0;
+      return;
+   }
+   infile.ignore();                         // throw away '\n' to go to next line
+
+   // get descriptions of vertices
+   vertices = new Vertex*[size];
+   for (int v = 0; v < size; v++) {
+      string name;
+      getline(infile, name, '\n');
+      vertices[v] = new Vertex(name);
+   }
+
+   // first pass: spill the edges as read and count the edges of each vertex
+   string spillFileName = edgeFileName + ".tmp";
+   fstream spillFile(spillFileName, ios::in | ios::out | ios::binary | ios::trunc);
+   if (!spillFile.is_open()) {
+      cout << "Error: Can not open file " << spillFileName << endl;
+      deleteGraph();
+      return;
+   }
+
+   edgeStart = new long long[size + 1];
+   for (int v = 0; v <= size; v++)
+      edgeStart[v] = 0;
+
+   int src = 1, destination = 1, weight = 1;
+   for (;;) {
+      infile >> src >> destination >> weight;
+      if (src == 0 || infile.eof())
+         break;
+      if (src < 1 || src > size || destination < 1 || destination > size || weight < 0)
+         continue;
+
+      int edge[3] = { src - 1, destination - 1, weight };
+      if (!spillFile.write((const char*)edge, sizeof(edge))) {
+         cout << "Error: Can not write file " << spillFileName << endl;
+         spillFile.close();
+         remove(spillFileName.c_str());
+         deleteGraph();
+         return;
+      }
+      edgeStart[src]++;
+      edgeCount++;
+   }
+
+   for (int v = 0; v < size; v++)
+      edgeStart[v + 1] += edgeStart[v];
+
+   // second pass: place every edge in the slot range of its source vertex
+   edgeFile.open(edgeFileName, ios::in | ios::out | ios::binary | ios::trunc);
+
+   long long* next = new long long[size];
+   for (int v = 0; v < size; v++)
+      next[v] = edgeStart[v];
+
+   bool written = edgeFile.is_open() && spillFile.seekg(0);
+   for (long long i = 0; i < edgeCount && written; i++) {
+      int edge[3];
+      if (!spillFile.read((char*)edge, sizeof(edge)) ||
+         edge[0] < 0 || edge[0] >= size || next[edge[0]] >= edgeStart[edge[0] + 1]) {
+         written = false;
+         break;
+      }
+
+      EdgeRecord record;
+      record.adjVertex = edge[1];
+      record.weight = edge[2];
+      written = edgeFile.seekp(next[edge[0]]++ * (long long)sizeof(EdgeRecord)) &&
+         edgeFile.write((const char*)&record, sizeof(record));
+   }
+   written = written && mergeRepeatedEdges() && edgeFile.flush();
+
+   delete[] next;
+   spillFile.close();
+   remove(spillFileName.c_str());
+
+   if (!written) {
+      cout << "Error: Can not write file " << edgeFileName << endl;
+      deleteGraph();
+      return;
+   }
+
+   row = new Table[size];
+}
+
+//------------------------------------------------------------------------
+// Builds the table with shortest path and writes it to the table file
+// @pre the graph is already being built from the input file
+// @post the table file holds the shortest path row of every vertex
+void ExternalGraph::findShortestPath() {
+   tableFile.close();
+   rowSource = -1;
+   if (size == 0) return;
+
+   tableFile.open(tableFileName, ios::in | ios::out | ios::binary | ios::trunc);
+   if (!tableFile.is_open()) {
+      cout << "Error: Can not open file " << tableFileName << endl;
+      deleteGraph();
+      return;
+   }
+
+   for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j++) {
+         row[j].visited = false;
+         row[j].path = INFINITE;
+         row[j].dist = INFINITE;
+      }
+
+      row[i].path = 0;
+      row[i].dist = 0;
+      row[i].visited = true;
+      bool computed = recomputeWeight(i);
+
+      // find shortest path for all vertices
+      for (int j = 0; j < size && computed; j++) {
+         int lowestMove = getLowestWeightUnvisited();
+         if (lowestMove == INFINITE)
+            break;
+         row[lowestMove].visited = true;
+         computed = recomputeWeight(lowestMove);
+      }
+
+      if (!computed) {
+         cout << "Error: Can not read file " << edgeFileName << endl;
+         deleteGraph();
+         return;
+      }
+
+      // rows are written in source order, so the file stays sequential
+      for (int j = 0; j < size && tableFile; j++) {
+         int entry[2] = { row[j].dist, row[j].path };
+         tableFile.write((const char*)entry, sizeof(entry));
+      }
+
+      if (!tableFile) {
+         cout << "Error: Can not write file " << tableFileName << endl;
+         deleteGraph();
+         return;
+      }
+   }
+
+   if (!tableFile.flush()) {
+      cout << "Error: Can not write file " << tableFileName << endl;
+      deleteGraph();
+      return;
+   }
+   rowSource = size - 1;
+}
+
+//------------------------------------------------------------------------
+// Merges the repeated edges of every vertex in the edge file
+// Like Graph::insertEdge, a repeated edge keeps the place of its first
+// occurrence and the weight of its last one.
+// @pre the edge file holds the edges grouped by source vertex
+// @post edgeStart and edgeCount describe the merged edge file
+// @returns false when the edge file can not be read or written
+bool ExternalGraph::mergeRepeatedEdges() {
+   int* lastWeight = new int[size];
+   int* seenBy = new int[size];
+   for (int v = 0; v < size; v++)
+      seenBy[v] = -1;
+
+   // the pool is still empty, so its first buffer is borrowed for the merge
+   EdgeRecord* buffer = frames[0].edges;
+   long long written = 0;
+   bool merged = true;
+
+   for (int v = 0; v < size && merged; v++) {
+      long long start = edgeStart[v];
+      long long end = edgeStart[v + 1];
+      edgeStart[v] = written;
+
+      // first pass: find the last weight of every adjacent vertex
+      for (long long i = start; i < end && merged; i += BLOCK_EDGES) {
+         int count = end - i < BLOCK_EDGES ? (int)(end - i) : BLOCK_EDGES;
+         merged = edgeFile.seekg(i * (long long)sizeof(EdgeRecord)) &&
+            edgeFile.read((char*)buffer, count * sizeof(EdgeRecord));
+
+         for (int e = 0; e < count && merged; e++) {
+            merged = buffer[e].adjVertex >= 0 && buffer[e].adjVertex < size;
+            if (merged)
+               lastWeight[buffer[e].adjVertex] = buffer[e].weight;
+         }
+      }
+
+      // second pass: keep the first edge to every adjacent vertex, the
+      // merged edges never pass the ones not read yet
+      for (long long i = start; i < end && merged; i += BLOCK_EDGES) {
+         int count = end - i < BLOCK_EDGES ? (int)(end - i) : BLOCK_EDGES;
+         merged = edgeFile.seekg(i * (long long)sizeof(EdgeRecord)) &&
+            edgeFile.read((char*)buffer, count * sizeof(EdgeRecord));
+
+         int kept = 0;
+         for (int e = 0; e < count && merged; e++) {
+            int adjVertex = buffer[e].adjVertex;
+            merged = adjVertex >= 0 && adjVertex < size;
+            if (merged && seenBy[adjVertex] != v) {
+               seenBy[adjVertex] = v;
+               buffer[kept].adjVertex = adjVertex;
+               buffer[kept++].weight = lastWeight[adjVertex];
+            }
+         }
+
+         merged = merged && edgeFile.seekp(written * (long long)sizeof(EdgeRecord)) &&
+            edgeFile.write((const char*)buffer, kept * sizeof(EdgeRecord));
+         written += kept;
+      }
+   }
+
+   delete[] lastWeight;
+   delete[] seenBy;
+
+   if (!merged) return false;
+
+   edgeStart[size] = written;
+   edgeCount = written;
+   return true;
+}
+
+//------------------------------------------------------------------------
+// Returns the home slot of the given block in blockSlots
+// @pre none
+// @post none
+// @param block The block of the edge file
+// @returns the slot where the search for the block starts
+int ExternalGraph::getHomeSlot(long long block) const {
+   // Fibonacci hashing spreads the consecutive blocks of a vertex
+   return (int)(((unsigned long long)block * 11400714819323198485ULL) >> 33) & slotMask;
+}
+
+//------------------------------------------------------------------------
+// Finds the buffer holding the given block
+// @pre none
+// @post none
+// @param block The block of the edge file
+// @returns the buffer holding the block, -1 when it is not in the pool
+int ExternalGraph::findFrame(long long block) const {
+   for (int s = getHomeSlot(block); blockSlots[s] != -1; s = (s + 1) & slotMask)
+      if (frames[blockSlots[s]].block == block)
+         return blockSlots[s];
+
+   return -1;
+}
+
+//------------------------------------------------------------------------
+// Adds the given buffer to blockSlots under the block it holds
+// @pre the buffer holds a block and is not in blockSlots
+// @post the buffer can be found by its block
+// @param frame The buffer
+void ExternalGraph::insertFrame(int frame) {
+   int s = getHomeSlot(frames[frame].block);
+   while (blockSlots[s] != -1)
+      s = (s + 1) & slotMask;
+   blockSlots[s] = frame;
+}
+
+//------------------------------------------------------------------------
+// Removes the given buffer from blockSlots
+// Later buffers of the same probe run are moved back into the freed slot,
+// so no search stops early at it.
+// @pre the buffer holds a block and is in blockSlots
+// @post the buffer can no longer be found by its block
+// @param frame The buffer
+void ExternalGraph::removeFrame(int frame) {
+   int freed = getHomeSlot(frames[frame].block);
+   while (blockSlots[freed] != frame)
+      freed = (freed + 1) & slotMask;
+   blockSlots[freed] = -1;
+
+   for (int s = (freed + 1) & slotMask; blockSlots[s] != -1; s = (s + 1) & slotMask) {
+      // a buffer may move back only if its home is not after the freed slot
+      int home = getHomeSlot(frames[blockSlots[s]].block);
+      if (((s - home) & slotMask) >= ((s - freed) & slotMask)) {
+         blockSlots[freed] = blockSlots[s];
+         blockSlots[s] = -1;
+         freed = s;
+      }
+   }
+}
+
+//------------------------------------------------------------------------
+// Returns the edges of the given block, reading it through the buffer pool
+// @pre block holds edges of the edge file
+// @post the block is present in the buffer pool as its newest buffer
+// @param block The block of the edge file
+// @returns the edge records, nullptr when the edge file can not be read
+const ExternalGraph::EdgeRecord* ExternalGraph::getBlock(long long block) {
+   int current = findFrame(block);
+
+   if (current == -1) {
+      // replace the least recently used buffer with the missing block
+      current = oldestFrame;
+      Frame& frame = frames[current];
+      if (frame.block != -1)
+         removeFrame(current);
+
+      long long remaining = edgeCount - block * BLOCK_EDGES;
+      frame.count = remaining < BLOCK_EDGES ? (int)remaining : BLOCK_EDGES;
+      frame.block = -1;
+
+      // a block that was not fully read is never kept in the pool
+      if (!edgeFile.seekg(block * BLOCK_EDGES * (long long)sizeof(EdgeRecord)) ||
+         !edgeFile.read((char*)frame.edges, frame.count * sizeof(EdgeRecord))) {
+         edgeFile.clear();
+         return nullptr;
+      }
+
+      frame.block = block;
+      insertFrame(current);
+   }
+
+   // move the buffer to the front of the LRU list
+   Frame& frame = frames[current];
+   if (current != newestFrame) {
+      frames[frame.prevFrame].nextFrame = frame.nextFrame;
+      if (frame.nextFrame != -1)
+         frames[frame.nextFrame].prevFrame = frame.prevFrame;
+      else
+         oldestFrame = frame.prevFrame;
+
+      frame.prevFrame = -1;
+      frame.nextFrame = newestFrame;
+      frames[newestFrame].prevFrame = current;
+      newestFrame = current;
+   }
+
+   return frame.edges;
+}
+
+//------------------------------------------------------------------------
+// Finds the next unvisited vertex with lowest weight in the current row
+// @pre none
+// @post returns the next unvisited vertex with lowest weight
+// @returns the next unvisited vertex with lowest weight
+int ExternalGraph::getLowestWeightUnvisited() const {
+   int minVertex = INFINITE;
+   int minWeight = INFINITE;
+   for (int i = 0; i < size; i++)
+      if (!row[i].visited && row[i].dist < minWeight) {
+         minVertex = i;
+         minWeight = row[i].dist;
+      }
+
+   return minVertex;
+}
+
+//------------------------------------------------------------------------
+// Recomputes the path and weights of the neighbors of the given vertex
+// @pre vertex is a valid vertex value
+// @post The new shortest path is computed with weights in the current row
+// @param vertex The vertex just visited
+// @returns false when the edges can not be read from the edge file
+bool ExternalGraph::recomputeWeight(int vertex) {
+   long long i = edgeStart[vertex];
+   while (i < edgeStart[vertex + 1]) {
+      const EdgeRecord* edges = getBlock(i / BLOCK_EDGES);
+      if (edges == nullptr)
+         return false;
+
+      // visit the edges of the vertex held in this block
+      long long blockEnd = (i / BLOCK_EDGES + 1) * BLOCK_EDGES;
+      long long end = blockEnd < edgeStart[vertex + 1] ? blockEnd : edgeStart[vertex + 1];
+      for (; i < end; i++) {
+         const EdgeRecord& edge = edges[i % BLOCK_EDGES];
+         if (edge.adjVertex < 0 || edge.adjVertex >= size || edge.weight < 0)
+            return false;
+
+         if (!row[edge.adjVertex].visited) {
+            if (row[edge.adjVertex].path == INFINITE || row[edge.adjVertex].dist > row[vertex].dist + edge.weight) {
+               row[edge.adjVertex].dist = row[vertex].dist + edge.weight;
+               row[edge.adjVertex].path = vertex + 1;
+            }
+         }
+      }
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------
+// Loads the shortest path row of the given source from the table file
+// @pre findShortestPath has been called and source is a valid vertex
+// @post row holds the shortest paths from source
+// @param source The source vertex
+// @returns false when the row can not be read from the table file
+bool ExternalGraph::loadRow(int source) {
+   if (rowSource == source) return true;
+
+   // a row that was not fully read is never used
+   rowSource = -1;
+   if (!tableFile.is_open() ||
+      !tableFile.seekg((long long)source * size * 2 * (long long)sizeof(int))) {
+      tableFile.clear();
+      return false;
+   }
+
+   for (int j = 0; j < size; j++) {
+      int entry[2];
+      if (!tableFile.read((char*)entry, sizeof(entry)) ||
+         (entry[1] != INFINITE && (entry[1] < 0 || entry[1] > size))) {
+         tableFile.clear();
+         return false;
+      }
+      row[j].dist = entry[0];
+      row[j].path = entry[1];
+   }
+
+   rowSource = source;
+   return true;
+}
+
+//------------------------------------------------------------------------
+// Displays a formatted details of shortest path for all vertices
+// @pre findShortestPath has been called
+// @post displays the formatted shortest paths details
+void ExternalGraph::displayAll() {
+   if (size > 0 && !tableFile.is_open()) {
+      cout << "Error: Shortest paths are not found yet" << endl;
+      return;
+   }
+
+   cout << setw(20) << left << "Description"
+      << setw(10) << left << "From"
+      << setw(10) << left << "To"
+      << setw(10) << left << "Dist"
+      << setw(10) << left << "Path" << endl;
+
+   for (int i = 0; i < size; i++) {
+      if (!loadRow(i)) {
+         cout << "Error: Can not read file " << tableFileName << endl;
+         return;
+      }
+
+      cout << *vertices[i] << endl;
+      for (int j = 0; j < size; j++) {
+         if (row[j].path != INFINITE && row[j].path != 0) {
+            cout << setw(20) << left << ""
+               << setw(10) << left << i + 1
+               << setw(10) << left << j + 1
+               << setw(10) << left << row[j].dist;
+
+            displayRecursive(j);
+            cout << j + 1;
+
+            cout << endl;
+         }
+         else if (row[j].path == INFINITE) {
+            cout << setw(20) << left << ""
+               << setw(10) << left << i + 1
+               << setw(10) << left << j + 1
+               << setw(10) << left << "--" << endl;
+         }
+      }
+   }
+}
+
+//------------------------------------------------------------------------
+// Displays the shortest path details from source to destinaion vertex
+// @pre findShortestPath has been called
+// @post displays the shortest path from source to destination with details
+// @param source The source vertex
+// @param destination The destination vertex
+void ExternalGraph::display(int source, int destination) {
+   if (source < 1 || source > size || destination < 1 || destination > size) {
+      cout << "Error: Enter valid source or destination value" << endl;
+      return;
+   }
+
+   if (!tableFile.is_open()) {
+      cout << "Error: Shortest paths are not found yet" << endl;
+      return;
+   }
+
+   if (!loadRow(source - 1)) {
+      cout << "Error: Can not read file " << tableFileName << endl;
+      return;
+   }
+
+   if (row[destination - 1].dist == INFINITE) {
+      cout << "Error: No path exist from " << source << " to " << destination << endl;
+      return;
+   }
+
+   cout << source << '\t' << destination << '\t' << row[destination - 1].dist << '\t';
+   displayRecursive(destination - 1);
+   cout << destination << endl;
+   displayPathNamesRecursive(destination - 1);
+}
+
+//------------------------------------------------------------------------
+// Displays the shortest path to destinaion vertex from the current row
+// @pre destination is a valid vertex value
+// @post displays the shortest path to destination
+// @param destination The destination vertex
+void ExternalGraph::displayRecursive(int destination) const {
+   if (row[destination].path == 0) return;
+   displayRecursive(row[destination].path - 1);
+   cout << row[destination].path << " ";
+}
+
+//------------------------------------------------------------------------
+// Displays the shortest path vertex names to destinaion vertex
+// @pre destination is a valid vertex value
+// @post displays the shortest path vertex names to destination
+// @param destination The destination vertex
+void ExternalGraph::displayPathNamesRecursive(int destination) const {
+   if (row[destination].path == 0) {
+      cout << *vertices[destination] << endl;
+   }
+   else if (row[destination].path > 0) {
+      displayPathNamesRecursive(row[destination].path - 1);
+      cout << *vertices[destination] << endl;
+   }
+}
+
+//------------------------------------------------------------------------
+// Deletes all the data from the Graph and deallocates the assigned memory
+// The buffer pool is kept, its buffers are only marked empty.
+// @pre none
+// @post all Graph data is deleted and memory freed
+void ExternalGraph::deleteGraph() {
+   for (int i = 0; i < size; i++) {
+      delete vertices[i];
+      vertices[i] = nullptr;
+   }
+
+   delete[] vertices;
+   vertices = nullptr;
+   delete[] edgeStart;
+   edgeStart = nullptr;
+   delete[] row;
+   row = nullptr;
+
+   for (int i = 0; i < frameCount; i++)
+      frames[i].block = -1;
+   for (int s = 0; s <= slotMask; s++)
+      blockSlots[s] = -1;
+
+   edgeFile.close();
+   tableFile.close();
+   size = 0;
+   edgeCount = 0;
+   rowSource = -1;
+}
+
+//------------------------------------------------------------------------
+// The ExternalGraph object destructor
+// @pre none
+// @post the graph object is completely deleted
+//    with corresponding memory deallocated
+ExternalGraph::~ExternalGraph() {
+   deleteGraph();
+
+   for (int i = 0; i < frameCount; i++)
+      delete[] frames[i].edges;
+   delete[] frames;
+   delete[] blockSlots;
+}
\ No newline at end of file
@@ -0,0 +1,219 @@
+//---------------------------------------------------------------------------
+// File: ExternalGraph.h
+// Author: Snehal Jogdand
+// Date: 10/18/2026
+// Program 3: Dijkstra's algorithm
+//
+// DESCRIPTION:
+// ExternalGraph:
+//  The header file for ExternalGraph class
+//  Out-of-core variant of Graph for inputs whose edges or all-pairs table
+//  do not fit in memory. Edges are kept on disk grouped by source vertex
+//  and read through a bounded pool of block buffers; every shortest path
+//  row is written to a table file as soon as it is computed.
+//  Only O(V) working arrays plus the buffer pool are held in memory.
+//---------------------------------------------------------------------------
+
+#ifndef EXTERNAL_GRAPH_
+#define EXTERNAL_GRAPH_
+
+#include "Vertex.h"
+#include <climits>
+#include <iostream>
+#include <fstream>
+
+using namespace std;
+
+class ExternalGraph {
+public:
+   //------------------------------------------------------------------------
+   // The constructor that creates a new ExternalGraph object
+   // @pre edgeFileName and tableFileName are writable paths
+   // @post creates an ExternalGraph object with size 0
+   // @param edgeFileName The file that will hold the edges on disk
+   // @param tableFileName The file that will hold the shortest path rows
+   // @param memoryLimit The number of bytes the edge buffer pool, with its
+   //    block lookup table, may use; at least one buffer is always kept
+   ExternalGraph(const string& edgeFileName, const string& tableFileName,
+      long long memoryLimit);
+
+   // the graph owns its backing files, so it can not be copied
+   ExternalGraph(const ExternalGraph& graph) = delete;
+   ExternalGraph& operator=(const ExternalGraph& rhs) = delete;
+
+   //------------------------------------------------------------------------
+   // Builds the graph from the provided input file stream in inFile
+   // On a file error the graph is left empty.
+   // Edges are streamed to the edge file and are never held in memory.
+   // A repeated edge replaces the earlier one, as in Graph::insertEdge.
+   // @pre infile correctly formatted input file stream
+   // @post builds the graph object with its edges stored on disk
+   // @param infile The file input stream object
+   void buildGraph(ifstream& infile);
+
+   //------------------------------------------------------------------------
+   // Builds the table with shortest path and writes it to the table file
+   // On a file error the graph is left empty.
+   // @pre the graph is already being built from the input file
+   // @post the table file holds the shortest path row of every vertex
+   void findShortestPath();
+
+   //------------------------------------------------------------------------
+   // Displays a formatted details of shortest path for all vertices
+   // On a file error the graph is kept and the error is displayed.
+   // @pre findShortestPath has been called
+   // @post displays the formatted shortest paths details
+   void displayAll();
+
+   //------------------------------------------------------------------------
+   // Displays the shortest path details from source to destinaion vertex
+   // On a file error the graph is kept and the error is displayed.
+   // @pre findShortestPath has been called
+   // @post displays the shortest path from source to destination with details
+   // @param source The source vertex
+   // @param destination The destination vertex
+   void display(int source, int destination);
+
+   //------------------------------------------------------------------------
+   // The ExternalGraph object destructor
+   // @pre none
+   // @post the graph object is completely deleted
+   //    with corresponding memory deallocated
+   ~ExternalGraph();
+
+private:
+   static const int INFINITE = INT_MAX;
+   static const int BLOCK_EDGES = 512;   // edges read from disk at a time
+
+   // The edge record as stored in the edge file
+   struct EdgeRecord {
+      int adjVertex;       // subscript of the adjacent vertex
+      int weight;          // weight of edge
+   };
+
+   // A buffer of the pool holding one block of the edge file
+   struct Frame {
+      long long block;     // block of the edge file held, -1 when empty
+      int count;           // number of valid edges in the block
+      int prevFrame;       // more recently used buffer, -1 for the newest
+      int nextFrame;       // less recently used buffer, -1 for the oldest
+      EdgeRecord* edges;   // BLOCK_EDGES edge records
+   };
+
+   // one row of the table for Dijkstra's algorithm
+   struct Table {
+      bool visited;   // whether vertex has been visited
+      int dist;       // shortest known distance from source
+      int path;       // previous vertex in path of min dist
+   };
+
+   string edgeFileName;     // edges grouped by source vertex
+   string tableFileName;    // one row of dist, path pairs per source
+   fstream edgeFile;
+   fstream tableFile;
+
+   int size;                // number of vertices in the graph
+   Vertex** vertices;       // vertex data, size entries
+   long long* edgeStart;    // first edge of each vertex, size + 1 entries
+   long long edgeCount;     // number of edges in the edge file
+
+   Frame* frames;           // the buffer pool
+   int frameCount;          // number of buffers in the pool
+   int newestFrame;         // head of the buffers in LRU order
+   int oldestFrame;         // tail of the buffers in LRU order
+   int* blockSlots;         // open addressed table from block to buffer,
+                            // -1 for a free slot
+   int slotMask;            // number of slots - 1, a power of two - 1
+
+   Table* row;              // shortest path row currently in memory
+   int rowSource;           // source vertex of row, -1 when none
+
+   //------------------------------------------------------------------------
+   // Merges the repeated edges of every vertex in the edge file
+   // @pre the edge file holds the edges grouped by source vertex
+   // @post edgeStart and edgeCount describe the merged edge file
+   // @returns false when the edge file can not be read or written
+   bool mergeRepeatedEdges();
+
+   //------------------------------------------------------------------------
+   // Returns the home slot of the given block in blockSlots
+   // @pre none
+   // @post none
+   // @param block The block of the edge file
+   // @returns the slot where the search for the block starts
+   int getHomeSlot(long long block) const;
+
+   //------------------------------------------------------------------------
+   // Finds the buffer holding the given block
+   // @pre none
+   // @post none
+   // @param block The block of the edge file
+   // @returns the buffer holding the block, -1 when it is not in the pool
+   int findFrame(long long block) const;
+
+   //------------------------------------------------------------------------
+   // Adds the given buffer to blockSlots under the block it holds
+   // @pre the buffer holds a block and is not in blockSlots
+   // @post the buffer can be found by its block
+   // @param frame The buffer
+   void insertFrame(int frame);
+
+   //------------------------------------------------------------------------
+   // Removes the given buffer from blockSlots
+   // @pre the buffer holds a block and is in blockSlots
+   // @post the buffer can no longer be found by its block
+   // @param frame The buffer
+   void removeFrame(int frame);
+
+   //------------------------------------------------------------------------
+   // Returns the edges of the given block, reading it through the buffer pool
+   // @pre block holds edges of the edge file
+   // @post the block is present in the buffer pool as its newest buffer
+   // @param block The block of the edge file
+   // @returns the edge records, nullptr when the edge file can not be read
+   const EdgeRecord* getBlock(long long block);
+
+   //------------------------------------------------------------------------
+   // Finds the next unvisited vertex with lowest weight in the current row
+   // @pre none
+   // @post returns the next unvisited vertex with lowest weight
+   // @returns the next unvisited vertex with lowest weight
+   int getLowestWeightUnvisited() const;
+
+   //------------------------------------------------------------------------
+   // Recomputes the path and weights of the neighbors of the given vertex
+   // @pre vertex is a valid vertex value
+   // @post The new shortest path is computed with weights in the current row
+   // @param vertex The vertex just visited
+   // @returns false when the edges can not be read from the edge file
+   bool recomputeWeight(int vertex);
+
+   //------------------------------------------------------------------------
+   // Loads the shortest path row of the given source from the table file
+   // @pre findShortestPath has been called and source is a valid vertex
+   // @post row holds the shortest paths from source
+   // @param source The source vertex
+   // @returns false when the row can not be read from the table file
+   bool loadRow(int source);
+
+   //------------------------------------------------------------------------
+   // Displays the shortest path to destinaion vertex from the current row
+   // @pre destination is a valid vertex value
+   // @post displays the shortest path to destination
+   // @param destination The destination vertex
+   void displayRecursive(int destination) const;
+
+   //------------------------------------------------------------------------
+   // Displays the shortest path vertex names to destinaion vertex
+   // @pre destination is a valid vertex value
+   // @post displays the shortest path vertex names to destination
+   // @param destination The destination vertex
+   void displayPathNamesRecursive(int destination) const;
+
+   //------------------------------------------------------------------------
+   // Deletes all the data from the Graph and deallocates the assigned memory
+   // @pre none
+   // @post all Graph data is deleted and memory freed
+   void deleteGraph();
+};
+#endif
\ No newline at end of file
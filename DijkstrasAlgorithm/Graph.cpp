@@ -12,6 +12,7 @@
 
 #include <fstream>
 #include "Graph.h"
+#include <algorithm>
 #include <iomanip>
 
 using namespace std;
@@ -54,7 +55,8 @@ Graph::VertexNode::VertexNode(Vertex* vertex) : edgeHead(nullptr), data(vertex)
 // The default constructor that creates a new Graph object 
 // @pre none
 // @post creates a Graph object with size 0
-Graph::Graph() : size(0) {
+Graph::Graph() : size(0), spurThreadCount(0), spurRound(0), spurWorkers(0),
+   spurPending(0), spurStop(false) {
 }
 
 //------------------------------------------------------------------------
@@ -62,7 +64,8 @@ Graph::Graph() : size(0) {
 // @pre graph should be a valid Graph object
 // @post creates a deep copy of give Graph object
 // @param graph The graph to be copied
-Graph::Graph(const Graph& graph) {
+Graph::Graph(const Graph& graph) : size(0), spurThreadCount(0), spurRound(0),
+   spurWorkers(0), spurPending(0), spurStop(false) {
    deleteGraph();
 
    if (graph.size == 0) return;
@@ -268,7 +271,7 @@ void Graph::findShortestPath() {
 int Graph::getLowestWeightUnvisited(int source) const {
    int minVertex = INFINITE;
    int minWeight = INFINITE;
-   for (int i = 0; i < size - 1; i++)
+   for (int i = 0; i < size; i++)
       if (!T[source][i].visited && T[source][i].dist < minWeight) {
          minVertex = i;
          minWeight = T[source][i].dist;
@@ -384,6 +387,343 @@ void Graph::displayPathNamesRecursive(int source, int destination) const {
    }
 }
 
+//------------------------------------------------------------------------
+// Finds up to k shortest loopless paths from source to destination
+// Uses Yen's algorithm. The spur searches reuse the shortest path tree
+// toward destination and run on preallocated buffers, in parallel on
+// worker threads owned by the graph when a round is large enough.
+// The found and candidate paths and the vectors of paths are reused, so
+// a query only allocates when it needs more room than earlier queries.
+// @pre source and destination are valid vertex values
+// @post paths holds the found paths in order of increasing distance
+// @param source The source vertex
+// @param destination The destination vertex
+// @param k The number of paths wanted
+// @param paths The found paths, each the vertex ids from source to destination
+// @returns the number of paths found
+int Graph::findKShortestPaths(int source, int destination, int k, vector<vector<int> >& paths) {
+   if (source < 1 || source > size || destination < 1 || destination > size) {
+      cout << "Error: Enter valid source or destination value" << endl;
+      paths.clear();
+      return 0;
+   }
+
+   if (k < 1) {
+      paths.clear();
+      return 0;
+   }
+
+   buildReverseTree(destination - 1);
+   if (toDestDist[source - 1] == INFINITE) {
+      paths.clear();
+      return 0;
+   }
+
+   // the buffers keep their capacity from earlier searches
+   vector<Path>& found = foundPaths;
+   vector<Path>& candidates = candidatePaths;
+   found.clear();
+   candidates.clear();
+
+   // the first path follows the tree from source
+   found.resize(1);
+   Path& first = found[0];
+   first.dist = toDestDist[source - 1];
+   first.length = 0;
+   for (int v = source - 1; v != -1; v = toDestNext[v])
+      first.ids[first.length++] = v;
+
+   unsigned int cores = thread::hardware_concurrency();
+   int maxWorkers = cores == 0 || cores > SPUR_WORKERS ? SPUR_WORKERS : (int)cores;
+
+   while ((int)found.size() < k) {
+      int spurCount = found.back().length - 1;
+      int workers = spurCount < maxWorkers ? spurCount : maxWorkers;
+
+      // a small round costs less than waking the worker threads
+      if ((long long)spurCount * size * size < PARALLEL_SPUR_WORK)
+         workers = 1;
+
+      if (workers > 1)
+         runSpurRound(workers);
+      else
+         findSpurPaths(0, 1);
+
+      // merged in spur order, so the result does not depend on the workers
+      for (int i = 0; i < spurCount; i++) {
+         const Path& spur = spurPaths[i];
+         if (spur.length == 0) continue;
+
+         bool duplicate = false;
+         for (size_t c = 0; c < candidates.size() && !duplicate; c++)
+            duplicate = candidates[c].length == spur.length &&
+               equal(spur.ids, spur.ids + spur.length, candidates[c].ids);
+         if (!duplicate)
+            candidates.push_back(spur);
+      }
+
+      if (candidates.empty()) break;
+
+      size_t best = 0;
+      for (size_t c = 1; c < candidates.size(); c++)
+         if (candidates[c].dist < candidates[best].dist ||
+            (candidates[c].dist == candidates[best].dist && candidates[c].length < candidates[best].length))
+            best = c;
+
+      // the candidate order does not matter, so the last one fills the gap
+      found.push_back(candidates[best]);
+      candidates[best] = candidates.back();
+      candidates.pop_back();
+   }
+
+   paths.resize(found.size());
+   for (size_t p = 0; p < found.size(); p++) {
+      paths[p].resize(found[p].length);
+      for (int i = 0; i < found[p].length; i++)
+         paths[p][i] = found[p].ids[i] + 1;
+   }
+
+   return (int)paths.size();
+}
+
+//------------------------------------------------------------------------
+// Returns the weight of the edge from source to destination vertex
+// @pre source and destination are valid vertex subscripts
+// @post none
+// @param source The source vertex
+// @param destination The destination vertex
+// @returns the weight of the edge, INFINITE when there is no edge
+int Graph::getEdgeWeight(int source, int destination) const {
+   for (EdgeNode* current = vertices[source].edgeHead; current != nullptr; current = current->nextEdge)
+      if (current->adjVertex == destination)
+         return current->weight;
+
+   return INFINITE;
+}
+
+//------------------------------------------------------------------------
+// Builds the shortest path tree toward the given destination vertex
+// @pre destination is a valid vertex subscript
+// @post toDestDist and toDestNext hold the tree
+// @param destination The destination vertex
+void Graph::buildReverseTree(int destination) {
+   // group the edges by destination, in order of their source vertex
+   for (int v = 0; v <= size; v++)
+      inStart[v] = 0;
+   for (int v = 0; v < size; v++)
+      for (EdgeNode* current = vertices[v].edgeHead; current != nullptr; current = current->nextEdge)
+         inStart[current->adjVertex + 1]++;
+   for (int v = 0; v < size; v++)
+      inStart[v + 1] += inStart[v];
+
+   int next[MAX_VERTICES];
+   for (int v = 0; v < size; v++)
+      next[v] = inStart[v];
+   inSource.resize(inStart[size]);
+   inWeight.resize(inStart[size]);
+   for (int v = 0; v < size; v++)
+      for (EdgeNode* current = vertices[v].edgeHead; current != nullptr; current = current->nextEdge) {
+         inSource[next[current->adjVertex]] = v;
+         inWeight[next[current->adjVertex]++] = current->weight;
+      }
+
+   bool* visited = spurScratch[0].visited;
+   for (int v = 0; v < size; v++) {
+      visited[v] = false;
+      toDestDist[v] = INFINITE;
+      toDestNext[v] = -1;
+   }
+   toDestDist[destination] = 0;
+
+   for (int n = 0; n < size; n++) {
+      int lowest = -1;
+      for (int v = 0; v < size; v++)
+         if (!visited[v] && toDestDist[v] != INFINITE && (lowest == -1 || toDestDist[v] < toDestDist[lowest]))
+            lowest = v;
+      if (lowest == -1) break;
+      visited[lowest] = true;
+
+      // relax the edges coming into the lowest vertex
+      for (int e = inStart[lowest]; e < inStart[lowest + 1]; e++) {
+         int v = inSource[e];
+         if (!visited[v] && (long long)toDestDist[lowest] + inWeight[e] < toDestDist[v]) {
+            toDestDist[v] = toDestDist[lowest] + inWeight[e];
+            toDestNext[v] = lowest;
+         }
+      }
+   }
+}
+
+//------------------------------------------------------------------------
+// Finds the spur paths of one worker for the last path found
+// Worker w handles the spur vertices w, w + workers, w + 2 * workers...
+// @pre the reverse tree toward the destination is built
+// @post spurPaths holds the spur path of every handled spur vertex
+// @param worker The worker, selects the buffers in spurScratch
+// @param workers The number of workers
+void Graph::findSpurPaths(int worker, int workers) {
+   for (int i = worker; i < foundPaths.back().length - 1; i += workers)
+      findSpurPath(spurScratch[worker], i, spurPaths[i]);
+}
+
+//------------------------------------------------------------------------
+// Finds the spur paths of the last path found on the worker threads
+// The worker threads are started on the first call.
+// @pre the reverse tree toward the destination is built
+// @post spurPaths holds the spur path of every spur vertex
+// @param workers The number of workers, the calling thread included
+void Graph::runSpurRound(int workers) {
+   for (; spurThreadCount < workers - 1; spurThreadCount++)
+      spurThreads[spurThreadCount] = thread(&Graph::runSpurWorker, this, spurThreadCount + 1);
+
+   {
+      lock_guard<mutex> lock(spurMutex);
+      spurWorkers = workers;
+      spurPending = workers - 1;
+      spurRound++;
+   }
+   spurStart.notify_all();
+
+   findSpurPaths(0, workers);
+
+   unique_lock<mutex> lock(spurMutex);
+   spurDone.wait(lock, [this] { return spurPending == 0; });
+}
+
+//------------------------------------------------------------------------
+// Runs the spur rounds of one worker thread until the graph is deleted
+// @pre none
+// @post the worker thread exits once spurStop is set
+// @param worker The worker, selects the buffers in spurScratch
+void Graph::runSpurWorker(int worker) {
+   long long round = 0;
+
+   unique_lock<mutex> lock(spurMutex);
+   for (;;) {
+      spurStart.wait(lock, [this, round] { return spurStop || spurRound != round; });
+      if (spurStop) return;
+      round = spurRound;
+
+      // workers past the size of the round sit it out
+      if (worker >= spurWorkers) continue;
+
+      int workers = spurWorkers;
+      lock.unlock();
+      findSpurPaths(worker, workers);
+      lock.lock();
+
+      if (--spurPending == 0)
+         spurDone.notify_one();
+   }
+}
+
+//------------------------------------------------------------------------
+// Stops and joins the worker threads of the spur searches
+// @pre none
+// @post no worker thread is running
+void Graph::stopSpurWorkers() {
+   {
+      lock_guard<mutex> lock(spurMutex);
+      spurStop = true;
+   }
+   spurStart.notify_all();
+
+   for (int i = 0; i < spurThreadCount; i++)
+      spurThreads[i].join();
+   spurThreadCount = 0;
+}
+
+//------------------------------------------------------------------------
+// Finds the shortest path that leaves the last found path at spurIndex
+// The search stops as soon as a visited vertex can follow the reverse
+// tree to the destination without using a removed vertex or edge.
+// @pre the reverse tree toward the destination is built
+// @post result holds the path, with length 0 when there is none
+// @param scratch The buffers used by the search
+// @param spurIndex The position of the spur vertex in the last path
+// @param result The found path
+void Graph::findSpurPath(SpurScratch& scratch, int spurIndex, Path& result) const {
+   const vector<Path>& found = foundPaths;
+   const Path& previous = found.back();
+   int spur = previous.ids[spurIndex];
+   result.length = 0;
+
+   for (int v = 0; v < size; v++) {
+      scratch.dist[v] = INFINITE;
+      scratch.path[v] = -1;
+      scratch.visited[v] = false;
+      scratch.blocked[v] = false;
+      scratch.blockedNext[v] = false;
+      scratch.onPath[v] = false;
+   }
+
+   // the root path vertices can not be used again
+   for (int i = 0; i <= spurIndex; i++)
+      scratch.blocked[previous.ids[i]] = true;
+
+   // nor the edges leaving the root path in any found path sharing the root
+   for (size_t p = 0; p < found.size(); p++)
+      if (found[p].length > spurIndex + 1 &&
+         equal(previous.ids, previous.ids + spurIndex + 1, found[p].ids))
+         scratch.blockedNext[found[p].ids[spurIndex + 1]] = true;
+
+   // A* search, the tree distance to destination is a consistent estimate
+   scratch.dist[spur] = 0;
+   for (;;) {
+      int lowest = -1;
+      long long lowestEstimate = 0;
+      for (int v = 0; v < size; v++) {
+         if (scratch.visited[v] || scratch.dist[v] == INFINITE || toDestDist[v] == INFINITE) continue;
+         long long estimate = (long long)scratch.dist[v] + toDestDist[v];
+         if (lowest == -1 || estimate < lowestEstimate) {
+            lowest = v;
+            lowestEstimate = estimate;
+         }
+      }
+      if (lowest == -1) return;
+      scratch.visited[lowest] = true;
+
+      // the tree path from lowest completes the cheapest possible path
+      // if it avoids the root path, the removed edges and the search path
+      for (int v = lowest; v != -1; v = scratch.path[v])
+         scratch.onPath[v] = true;
+      bool usable = lowest != spur || toDestNext[lowest] == -1 || !scratch.blockedNext[toDestNext[lowest]];
+      for (int v = toDestNext[lowest]; v != -1 && usable; v = toDestNext[v])
+         usable = !scratch.blocked[v] && !scratch.onPath[v];
+      for (int v = lowest; v != -1; v = scratch.path[v])
+         scratch.onPath[v] = false;
+
+      if (usable) {
+         int rootDist = 0;
+         for (int i = 0; i < spurIndex; i++)
+            rootDist += getEdgeWeight(previous.ids[i], previous.ids[i + 1]);
+
+         for (int i = 0; i < spurIndex; i++)
+            result.ids[result.length++] = previous.ids[i];
+         int start = result.length;
+         for (int v = lowest; v != -1; v = scratch.path[v])
+            result.ids[result.length++] = v;
+         reverse(result.ids + start, result.ids + result.length);
+         for (int v = toDestNext[lowest]; v != -1; v = toDestNext[v])
+            result.ids[result.length++] = v;
+
+         result.dist = rootDist + (int)lowestEstimate;
+         return;
+      }
+
+      for (EdgeNode* current = vertices[lowest].edgeHead; current != nullptr; current = current->nextEdge) {
+         int next = current->adjVertex;
+         if (scratch.visited[next] || scratch.blocked[next]) continue;
+         if (lowest == spur && scratch.blockedNext[next]) continue;
+
+         if ((long long)scratch.dist[lowest] + current->weight < scratch.dist[next]) {
+            scratch.dist[next] = scratch.dist[lowest] + current->weight;
+            scratch.path[next] = lowest;
+         }
+      }
+   }
+}
+
 //------------------------------------------------------------------------
 // Deletes all the data from the Graph and deallocates the assigned memory
 // @pre none
@@ -409,5 +749,6 @@ void Graph::deleteGraph() {
 // @post the graph object is completely deleted 
 //    with corresponding memory deallocated
 Graph::~Graph() {
+   stopSpurWorkers();
    deleteGraph();
 }
\ No newline at end of file
@@ -14,8 +14,13 @@
 #define GRAPH_
 
 #include "Vertex.h"
+#include <climits>
+#include <condition_variable>
 #include <iostream>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using namespace std;
 
@@ -85,6 +90,22 @@ public:
    // @param destination The destination vertex
    void display(int source, int destination);
 
+   //------------------------------------------------------------------------
+   // Finds up to k shortest loopless paths from source to destination
+   // Uses Yen's algorithm. The spur searches reuse the shortest path tree
+   // toward destination and run on preallocated buffers, in parallel on
+   // worker threads owned by the graph when a round is large enough.
+   // The found and candidate paths and the vectors of paths are reused, so
+   // a query only allocates when it needs more room than earlier queries.
+   // @pre source and destination are valid vertex values
+   // @post paths holds the found paths in order of increasing distance
+   // @param source The source vertex
+   // @param destination The destination vertex
+   // @param k The number of paths wanted
+   // @param paths The found paths, each the vertex ids from source to destination
+   // @returns the number of paths found
+   int findKShortestPaths(int source, int destination, int k, vector<vector<int> >& paths);
+
    //------------------------------------------------------------------------
    // The Graph object destructor 
    // @pre none
@@ -95,6 +116,9 @@ public:
 private:
    static const int INFINITE = INT_MAX;
    static const int MAX_VERTICES = 101;
+   static const int SPUR_WORKERS = 4;
+   static const int PARALLEL_SPUR_WORK = 1 << 16;   // spurs * V * V of a round
+                                                   // run on the worker threads
 
    // The edge node structure
    struct EdgeNode {       // can change to a class, if desired
@@ -151,6 +175,45 @@ private:
    // two dimensional in order to solve
    // for all sources
 
+   // a loopless path found by the k shortest paths search
+   struct Path {
+      int dist;                 // total weight of the path
+      int length;               // number of vertices, 0 when there is no path
+      int ids[MAX_VERTICES];    // subscripts of the vertices in path order
+   };
+
+   // buffers of one worker for the spur searches
+   struct SpurScratch {
+      int dist[MAX_VERTICES];          // shortest known distance from spur vertex
+      int path[MAX_VERTICES];          // previous vertex in path of min dist
+      bool visited[MAX_VERTICES];      // whether vertex has been visited
+      bool blocked[MAX_VERTICES];      // root path vertices that can not be used
+      bool blockedNext[MAX_VERTICES];  // spur vertex edges that can not be used
+      bool onPath[MAX_VERTICES];       // vertices of the path being checked
+   };
+
+   int toDestDist[MAX_VERTICES];    // distance to destination of k paths search
+   int toDestNext[MAX_VERTICES];    // next vertex toward that destination
+   int inStart[MAX_VERTICES + 1];   // first incoming edge of each vertex
+   vector<int> inSource;            // source vertex of each incoming edge
+   vector<int> inWeight;            // weight of each incoming edge
+   SpurScratch spurScratch[SPUR_WORKERS];
+   Path spurPaths[MAX_VERTICES];    // spur path found for each spur vertex
+   vector<Path> foundPaths;         // paths found by the current search
+   vector<Path> candidatePaths;     // spur paths not taken yet
+
+   // worker threads of the spur searches, started by the first large round;
+   // the calling thread is worker 0
+   thread spurThreads[SPUR_WORKERS - 1];
+   int spurThreadCount;             // number of started worker threads
+   mutex spurMutex;
+   condition_variable spurStart;    // signals a new round or stop
+   condition_variable spurDone;     // signals the end of a round
+   long long spurRound;             // number of rounds started
+   int spurWorkers;                 // workers of the current round
+   int spurPending;                 // worker threads still in the round
+   bool spurStop;                   // whether the worker threads should exit
+
    //------------------------------------------------------------------------
    // Finds the next unvisited vertex with lowest weight
    // @pre none
@@ -184,6 +247,63 @@ private:
    // @param destination The destination vertex
    void displayPathNamesRecursive(int source, int destination) const;
 
+   //------------------------------------------------------------------------
+   // Returns the weight of the edge from source to destination vertex
+   // @pre source and destination are valid vertex subscripts
+   // @post none
+   // @param source The source vertex
+   // @param destination The destination vertex
+   // @returns the weight of the edge, INFINITE when there is no edge
+   int getEdgeWeight(int source, int destination) const;
+
+   //------------------------------------------------------------------------
+   // Builds the shortest path tree toward the given destination vertex
+   // @pre destination is a valid vertex subscript
+   // @post toDestDist and toDestNext hold the tree
+   // @param destination The destination vertex
+   void buildReverseTree(int destination);
+
+   //------------------------------------------------------------------------
+   // Finds the spur paths of one worker for the last path found
+   // Worker w handles the spur vertices w, w + workers, w + 2 * workers...
+   // @pre the reverse tree toward the destination is built
+   // @post spurPaths holds the spur path of every handled spur vertex
+   // @param worker The worker, selects the buffers in spurScratch
+   // @param workers The number of workers
+   void findSpurPaths(int worker, int workers);
+
+   //------------------------------------------------------------------------
+   // Finds the spur paths of the last path found on the worker threads
+   // The worker threads are started on the first call.
+   // @pre the reverse tree toward the destination is built
+   // @post spurPaths holds the spur path of every spur vertex
+   // @param workers The number of workers, the calling thread included
+   void runSpurRound(int workers);
+
+   //------------------------------------------------------------------------
+   // Runs the spur rounds of one worker thread until the graph is deleted
+   // @pre none
+   // @post the worker thread exits once spurStop is set
+   // @param worker The worker, selects the buffers in spurScratch
+   void runSpurWorker(int worker);
+
+   //------------------------------------------------------------------------
+   // Stops and joins the worker threads of the spur searches
+   // @pre none
+   // @post no worker thread is running
+   void stopSpurWorkers();
+
+   //------------------------------------------------------------------------
+   // Finds the shortest path that leaves the last found path at spurIndex
+   // The search stops as soon as a visited vertex can follow the reverse
+   // tree to the destination without using a removed vertex or edge.
+   // @pre the reverse tree toward the destination is built
+   // @post result holds the path, with length 0 when there is none
+   // @param scratch The buffers used by the search
+   // @param spurIndex The position of the spur vertex in the last path
+   // @param result The found path
+   void findSpurPath(SpurScratch& scratch, int spurIndex, Path& result) const;
+
    //------------------------------------------------------------------------
    // Deletes all the data from the Graph and deallocates the assigned memory
    // @pre none